@@ -121,6 +121,24 @@ private:
    unsigned previous_r_state;
    unsigned current_r_state;
 
+   //Link map nodes found by the last complete refresh, keyed by node
+   // address, so that the names of libraries that are still loaded
+   // aren't read from the target again.  An entry is only reused if no
+   // unload has been seen since it was read, since dlclose and dlopen can
+   // hand a new library the old node, base and name buffer.
+   struct link_cache_entry {
+      Address name_addr;
+      Address load_addr;
+      Address ld_addr;
+      unsigned generation;
+      std::string name;
+   };
+   typedef std::map<Address, link_cache_entry> link_cache_t;
+   link_cache_t link_cache;
+   bool walked_link_map;
+   //Counts RT_DELETE states seen in r_debug
+   unsigned link_generation;
+
    Address r_debug_addr;
    Address trap_addr;
    Address getTrapAddrFromRdebug();
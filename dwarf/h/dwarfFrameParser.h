@@ -33,6 +33,7 @@
 
 #include <stack>
 #include <vector>
+#include <map>
 #include "dyntypes.h"
 #include "dyn_regs.h"
 #include "ProcReader.h"
@@ -57,6 +58,40 @@ typedef enum {
     FE_No_Error
 } FrameErrors_t;
 
+// One CFI row reduced to the forms compilers emit for almost every
+// instruction: the CFA is the stack or frame pointer plus a constant, and
+// the return address and frame pointer are either unchanged or saved at
+// a constant offset from the CFA.  Rows that need anything else are kept
+// with a *_complex rule so callers know to use full CFI evaluation.
+struct DYNDWARF_EXPORT CompactFrameRow {
+    typedef enum {
+        cfa_sp,
+        cfa_fp,
+        cfa_complex
+    } cfa_base_t;
+
+    typedef enum {
+        reg_same_value,
+        reg_undefined,
+        reg_at_cfa_offset,
+        reg_complex
+    } reg_rule_t;
+
+    Address lo;     // row covers [lo, hi)
+    Address hi;
+    cfa_base_t cfa_base;
+    long cfa_offset;
+    reg_rule_t ra_rule;
+    long ra_offset;
+    reg_rule_t fp_rule;
+    long fp_offset;
+
+    bool isSimple() const {
+        return cfa_base != cfa_complex && ra_rule == reg_at_cfa_offset &&
+            fp_rule != reg_complex;
+    }
+};
+
 class DYNDWARF_EXPORT DwarfFrameParser {
 public:
 
@@ -96,6 +131,19 @@ public:
             std::vector<VariableLocation> &locs,
             FrameErrors_t &err_result);
 
+    // Returns the compact form of the CFI row covering pc.  Rows are
+    // compiled from the CFI the first time any address in them is asked
+    // for and are found by a binary search on later lookups.
+    bool getCompactFrameRow(Address pc,
+            CompactFrameRow &row,
+            FrameErrors_t &err_result);
+
+    // Returns the compact rows of every FDE in address order, for callers
+    // that build their own table.  The rows are not added to the cache
+    // getCompactFrameRow searches.
+    bool getCompactFrameRows(std::vector<CompactFrameRow> &rows,
+            FrameErrors_t &err_result);
+
 
 private:
 
@@ -156,6 +204,13 @@ private:
     dyn_mutex cfi_lock;
     std::vector<Dwarf_CFI *> cfi_data;
 
+    bool compileFrameRow(Address pc, CompactFrameRow &row, FrameErrors_t &err_result);
+    bool getFDERanges(std::vector<std::pair<Address, Address> > &ranges);
+
+    // Compiled rows, keyed by the first address each covers.
+    dyn_rwlock compact_lock;
+    std::map<Address, CompactFrameRow> compact_rows;
+
 };
 
 }
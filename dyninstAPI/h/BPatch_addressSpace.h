@@ -72,6 +72,7 @@ class BPatch_statement;
 class BPatch_snippet;
 class BPatch_point;
 class BPatch_variableExpr;
+class BPatch_shardedCounter;
 class BPatch_type;
 class AddressSpace;
 class miniTrampHandle;
@@ -187,6 +188,9 @@ class BPATCH_DLL_EXPORT BPatch_addressSpace {
   
   std::vector<BPatch_register> registers_;
 
+  // DYNINST_samplingConfig_t shared by every BPatch_sampledExpr
+  BPatch_variableExpr *samplingConfig_;
+
  protected:
   virtual void getAS(std::vector<AddressSpace *> &as) = 0;
   
@@ -210,6 +214,7 @@ class BPATCH_DLL_EXPORT BPatch_addressSpace {
   bool findFuncsByRange(Dyninst::Address startAddr,
                         Dyninst::Address endAddr,
                         std::set<BPatch_function*> &funcs);
+  Dyninst::Address getSamplingConfigAddr();
   // end internal functions........ //
 
 
@@ -377,6 +382,40 @@ class BPATCH_DLL_EXPORT BPatch_addressSpace {
   
   bool free(BPatch_variableExpr &ptr);
 
+  //  BPatch_addressSpace::createShardedCounter
+  //
+  //  Allocate a counter with one cache-line padded slot per thread in the
+  //  mutatee; numShards == 0 picks one slot per CPU of the host.  Increment
+  //  it with BPatch_shardedCounterExpr and read it with
+  //  BPatch_shardedCounter::getValue.  Returns NULL for 32-bit mutatees.
+
+  BPatch_shardedCounter * createShardedCounter(std::string name,
+                                               unsigned numShards = 0);
+
+  //  BPatch_addressSpace::freeShardedCounter
+  //
+  //  Release a counter created by createShardedCounter.  Any snippets
+  //  that increment it must already have been removed.  Fails, leaving
+  //  the counter allocated, if it cannot be removed from the RT
+  //  library's exit-time report.
+
+  bool freeShardedCounter(BPatch_shardedCounter *counter);
+
+  //  BPatch_addressSpace::setSamplingPeriod
+  //
+  //  Run BPatch_sampledExpr bodies once every period invocations per
+  //  thread, or on average once every period invocations if randomize
+  //  is set.  Takes effect immediately; nothing is reinstrumented.
+  //  Fails if randomize is set and period is above 2^31.
+
+  bool setSamplingPeriod(unsigned period, bool randomize = false);
+
+  //  BPatch_addressSpace::getSamplingPeriod
+  //
+  //  Returns the current sampling period (1 if never set)
+
+  unsigned getSamplingPeriod();
+
   // BPatch_addressSpace::createVariable
   // 
   // Wrap an existing piece of allocated memory with a BPatch_variableExpr.
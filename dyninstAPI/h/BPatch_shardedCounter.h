@@ -0,0 +1,100 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef _BPatch_shardedCounter_h_
+#define _BPatch_shardedCounter_h_
+
+#include <string>
+#include <vector>
+#include "dyntypes.h"
+#include "BPatch_dll.h"
+#include "BPatch_snippet.h"
+
+class BPatch_addressSpace;
+class BPatch_variableExpr;
+
+// A counter split into per-thread, cache-line sized shards that live in
+// the mutatee's instrumentation heap.  Increments (BPatch_shardedCounterExpr)
+// only ever touch the executing thread's shard, so they need neither
+// atomics nor cross-core cache line transfers; the shards are summed
+// when the counter is read.  Counters are created with
+// BPatch_addressSpace::createShardedCounter.
+
+class BPATCH_DLL_EXPORT BPatch_shardedCounter {
+    friend class BPatch_addressSpace;
+
+    BPatch_addressSpace *addSpace_;
+    BPatch_variableExpr *storage_;   // raw allocation, including alignment slack
+    BPatch_variableExpr *header_;    // cache-line aligned DYNINST_shardedCounter_t
+    std::string name_;
+    unsigned numShards_;
+
+    BPatch_shardedCounter(BPatch_addressSpace *as,
+                          BPatch_variableExpr *storage,
+                          BPatch_variableExpr *header,
+                          const std::string &name,
+                          unsigned numShards);
+
+ public:
+    ~BPatch_shardedCounter();
+
+    //  BPatch_shardedCounter::getName
+    //  Returns the name reported by the RT library when dumping totals
+    const std::string &getName() const { return name_; }
+
+    //  BPatch_shardedCounter::getNumShards
+    //  Returns the number of per-thread slots backing this counter
+    unsigned getNumShards() const { return numShards_; }
+
+    //  BPatch_shardedCounter::getBaseAddr
+    //  Returns the address of the counter header in the mutatee
+    Dyninst::Address getBaseAddr() const;
+
+    //  BPatch_shardedCounter::getValue
+    //  Reads every shard in one transfer and returns their sum
+    bool getValue(long long &total);
+
+    //  BPatch_shardedCounter::getShardValues
+    //  Reads the individual shard values, one entry per shard
+    bool getShardValues(std::vector<long long> &values);
+
+    //  BPatch_shardedCounter::reset
+    //  Zeroes every shard
+    bool reset();
+};
+
+class BPATCH_DLL_EXPORT BPatch_shardedCounterExpr : public BPatch_snippet {
+ public:
+    //  BPatch_shardedCounterExpr::BPatch_shardedCounterExpr
+    //  Adds delta to the executing thread's shard of counter
+    BPatch_shardedCounterExpr(const BPatch_shardedCounter &counter, long delta = 1);
+};
+
+#endif /* _BPatch_shardedCounter_h_ */
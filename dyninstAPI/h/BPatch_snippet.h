@@ -489,7 +489,10 @@ class BPATCH_DLL_EXPORT BPatch_variableExpr : public BPatch_snippet
 class BPATCH_DLL_EXPORT BPatch_breakPointExpr : public BPatch_snippet {
  public:
     //  BPatch_breakPointExpr::BPatch_breakPointExpr
-    //  Creates a representation of a break point in the target process
+    //  Creates a representation of a break point in the target process.
+    //  For a conditional break point, wrap it in a BPatch_ifExpr; the
+    //  condition is then evaluated in the target and only a true result
+    //  stops the process.
 
     BPatch_breakPointExpr();
 };
@@ -554,6 +557,19 @@ class BPATCH_DLL_EXPORT BPatch_threadIndexExpr : public BPatch_snippet {
   BPatch_threadIndexExpr();
 };
 
+class BPATCH_DLL_EXPORT BPatch_sampledExpr : public BPatch_snippet {
+ public:
+  //
+  // BPatch_sampledExpr::BPatch_sampledExpr
+  //  Runs body only on the invocations selected by the sampling period of
+  //  addSpace (see BPatch_addressSpace::setSamplingPeriod).  Each thread
+  //  counts down its own invocations, so skipped invocations cost a call
+  //  into the RT library and no shared memory writes.  If the sampling
+  //  configuration cannot be allocated, an error is reported and the
+  //  snippet is left empty, so inserting it fails.
+  BPatch_sampledExpr(BPatch_addressSpace *addSpace, const BPatch_snippet &body);
+};
+
 class BPATCH_DLL_EXPORT BPatch_tidExpr : public BPatch_snippet {
  public:
   //
@@ -240,6 +240,10 @@ class AstNode : public Dyninst::PatchAPI::Snippet {
    static AstNodePtr threadIndexNode();
 
    static AstNodePtr scrambleRegistersNode();
+
+   // Run body only on invocations selected by the RT sampling guard,
+   // configured by the DYNINST_samplingConfig_t at config.
+   static AstNodePtr samplingGuardNode(AstNodePtr body, Address config);
    
    // TODO...
    // Needs some way of marking what to save and restore... should be a registerSpace, really
@@ -112,6 +112,11 @@ class baseTramp {
     int  stackHeight;
     bool skippedRedZone;
     bool wasFullFPRSave;
+
+    // Bytes of save, snippet, and restore code in the last generation
+    unsigned saveBytes;
+    unsigned bodyBytes;
+    unsigned restoreBytes;
     
     
     bool validOptimizationInfo() { return optimizationInfo_; }
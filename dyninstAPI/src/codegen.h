@@ -236,6 +236,7 @@ class codeGen {
 
     void beginTrackRegDefs();
     void endTrackRegDefs();
+    bool isTrackingRegDefs() const { return trackRegDefs_; }
     const bitArray &getRegsDefined();
     void markRegDefined(Register r);
     bool isRegDefined(Register r);
@@ -78,6 +78,7 @@ extern int dyn_debug_crash;
 extern int dyn_debug_rtlib;
 extern int dyn_debug_disassemble;
 extern int dyn_debug_stackmods;
+extern int dyn_debug_trampstats;
 
 extern char *dyn_debug_crash_debugger;
 
@@ -148,6 +149,7 @@ extern int write_printf_int(const char *format, ...);
 extern int infmalloc_printf_int(const char *format, ...);
 extern int crash_printf_int(const char *format, ...);
 extern int stackmods_printf_int(const char *format, ...);
+extern int trampstats_printf_int(const char *format, ...);
 
 #if defined(__GNUC__)
 
@@ -167,6 +169,7 @@ extern int stackmods_printf_int(const char *format, ...);
 #define infmalloc_printf(format, args...) do {if (dyn_debug_infmalloc) infmalloc_printf_int(format, ## args); } while(0)
 #define crash_printf(format, args...) do {if (dyn_debug_crash) crash_printf_int(format, ## args); } while(0)
 #define stackmods_printf(format, args...) do {if (dyn_debug_stackmods) stackmods_printf_int(format, ## args); } while(0)
+#define trampstats_printf(format, args...) do {if (dyn_debug_trampstats) trampstats_printf_int(format, ## args); } while(0)
 
 #else
 // Non-GCC doesn't have the ## macro
@@ -186,6 +189,7 @@ extern int stackmods_printf_int(const char *format, ...);
 #define infmalloc_printf infmalloc_printf_int
 #define crash_printf crash_printf_int
 #define stackmods_printf stackmods_printf_int
+#define trampstats_printf trampstats_printf_int
 
 
 #endif
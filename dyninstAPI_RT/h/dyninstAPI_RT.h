@@ -237,5 +237,46 @@ DLLEXPORT extern struct MemoryMapper RTmemoryMapper;
 
 extern int RTuntranslatedEntryCounter;
 
+/* Sharded counters (BPatch_shardedCounter).  The mutator allocates one
+ * header line followed by num_shards cache-line sized slots; each thread
+ * increments slot DYNINSTthreadIndex() % num_shards, so increments
+ * never share a line.  Only fixed-width fields are used so that the
+ * layout is identical for 32 and 64 bit mutatees. */
+#define DYNINST_CACHE_LINE_SIZE 64
+#define DYNINST_SHARDED_COUNTER_NAME_LEN (DYNINST_CACHE_LINE_SIZE - 16)
+
+typedef struct {
+   int64_t value;
+   char padding[DYNINST_CACHE_LINE_SIZE - sizeof(int64_t)];
+} DYNINST_counterShard_t;
+
+typedef struct {
+   uint32_t num_shards;
+   volatile uint32_t registered; /* set once the RT has seen this counter */
+   uint64_t next;                /* RT-private list of registered counters */
+   char name[DYNINST_SHARDED_COUNTER_NAME_LEN];
+   DYNINST_counterShard_t shards[]; //Don't change this to a pointer
+} DYNINST_shardedCounter_t;
+
+DLLEXPORT unsigned DYNINSTthreadIndex(void);
+DLLEXPORT void DYNINST_registerShardedCounter(DYNINST_shardedCounter_t *counter);
+DLLEXPORT int64_t DYNINST_shardedCounterTotal(DYNINST_shardedCounter_t *counter);
+DLLEXPORT void DYNINST_unregisterShardedCounter(DYNINST_shardedCounter_t *counter);
+DLLEXPORT void DYNINST_dumpShardedCounters(void);
+
+/* Sampling guard (BPatch_sampledExpr).  The mutator owns the configuration
+ * and may rewrite it at any time; a period of 0 or 1 runs every
+ * invocation, and randomize draws each interval uniformly from
+ * [1, 2*period-1] instead of using period exactly, so a randomized
+ * period may be at most DYNINST_MAX_RANDOM_SAMPLING_PERIOD. */
+#define DYNINST_MAX_RANDOM_SAMPLING_PERIOD 0x80000000u
+
+typedef struct {
+   volatile uint32_t period;
+   volatile uint32_t randomize;
+} DYNINST_samplingConfig_t;
+
+DLLEXPORT int DYNINST_sampleGuard(DYNINST_samplingConfig_t *config);
+
 #include "dyninstRTExport.h"
 #endif /* _DYNINSTAPI_RT_H */
@@ -39,6 +39,10 @@
 #include "dyninstAPI_RT/h/dyninstAPI_RT.h"
 #include "RTcommon.h"
 #include "RTthread.h"
+#if !defined(os_windows)
+#include <sys/mman.h>
+#include <pthread.h>
+#endif
 
 unsigned int DYNINSTobsCostLow;
 DLLEXPORT unsigned int DYNINSThasInitialized = 0;
@@ -604,6 +608,191 @@ int DYNINSTuserMessage(void *msg, unsigned int msg_size) {
     return 0;
 }
 
+/**
+ * Sharded counters.  Each thread is handed a dense index the first time it
+ * asks for one; the index is kept in static TLS.  Increments compute their
+ * shard inline from DYNINSTthreadIndex, which the mutator shares between
+ * every use in a snippet.  Threads beyond num_shards wrap around and share
+ * a shard with an earlier thread; the mutator sizes counters so that this
+ * is the rare case.
+ **/
+static TLS_VAR unsigned DYNINST_tls_thread_index = 0; /* 0 == unassigned */
+static volatile unsigned DYNINST_next_thread_index = 0;
+static DYNINST_shardedCounter_t *DYNINST_shardedCounterList = NULL;
+DECLARE_DYNINST_LOCK(DYNINST_counter_lock);
+
+static unsigned nextThreadIndex()
+{
+#if defined(_MSC_VER)
+   return (unsigned) InterlockedIncrement((volatile LONG *) &DYNINST_next_thread_index);
+#else
+   return __sync_add_and_fetch(&DYNINST_next_thread_index, 1);
+#endif
+}
+
+DLLEXPORT unsigned DYNINSTthreadIndex(void)
+{
+   unsigned index = DYNINST_tls_thread_index;
+   if (!index) {
+      index = nextThreadIndex();
+      DYNINST_tls_thread_index = index;
+   }
+   return index - 1;
+}
+
+/**
+ * Adds a counter to the exit-time report list.  Increments call this
+ * only while the counter's registered flag is still clear.
+ **/
+DLLEXPORT void DYNINST_registerShardedCounter(DYNINST_shardedCounter_t *counter)
+{
+   int first;
+
+   tc_lock_lock(&DYNINST_counter_lock);
+   if (counter->registered) {
+      tc_lock_unlock(&DYNINST_counter_lock);
+      return;
+   }
+   first = (DYNINST_shardedCounterList == NULL);
+   counter->next = (uint64_t) (uintptr_t) DYNINST_shardedCounterList;
+   DYNINST_shardedCounterList = counter;
+   counter->registered = 1;
+   tc_lock_unlock(&DYNINST_counter_lock);
+
+   if (first)
+      atexit(DYNINST_dumpShardedCounters);
+}
+
+/**
+ * Removes a counter from the exit-time report list.  The mutator calls
+ * this before freeing a counter's memory; it is a no-op for a counter
+ * that was never incremented.
+ **/
+DLLEXPORT void DYNINST_unregisterShardedCounter(DYNINST_shardedCounter_t *counter)
+{
+   DYNINST_shardedCounter_t *prev = NULL, *cur;
+
+   tc_lock_lock(&DYNINST_counter_lock);
+   for (cur = DYNINST_shardedCounterList; cur;
+        prev = cur, cur = (DYNINST_shardedCounter_t *) (uintptr_t) cur->next)
+   {
+      if (cur != counter) continue;
+      if (prev)
+         prev->next = counter->next;
+      else
+         DYNINST_shardedCounterList = (DYNINST_shardedCounter_t *) (uintptr_t) counter->next;
+      break;
+   }
+   counter->next = 0;
+   counter->registered = 0;
+   tc_lock_unlock(&DYNINST_counter_lock);
+}
+
+DLLEXPORT int64_t DYNINST_shardedCounterTotal(DYNINST_shardedCounter_t *counter)
+{
+   int64_t total = 0;
+   unsigned i;
+   for (i = 0; i < counter->num_shards; i++)
+      total += counter->shards[i].value;
+   return total;
+}
+
+/**
+ * Reports every counter that has been incremented at least once.  Called
+ * at exit so that rewritten binaries, which have no mutator attached to
+ * read the shards, can still report totals.  Output goes to the file
+ * named by DYNINST_SHARDED_COUNTER_OUTPUT ("-" for stderr); nothing is
+ * printed if it is unset.
+ **/
+DLLEXPORT void DYNINST_dumpShardedCounters(void)
+{
+   DYNINST_shardedCounter_t *counter;
+   const char *output = getenv("DYNINST_SHARDED_COUNTER_OUTPUT");
+   FILE *out;
+
+   if (!output || !*output) return;
+   if (!strcmp(output, "-"))
+      out = stderr;
+   else
+      out = fopen(output, "a");
+   if (!out) {
+      rtdebug_printf("%s[%d]: could not open %s for counter output\n",
+                     __FILE__, __LINE__, output);
+      return;
+   }
+
+   tc_lock_lock(&DYNINST_counter_lock);
+   for (counter = DYNINST_shardedCounterList; counter;
+        counter = (DYNINST_shardedCounter_t *) (uintptr_t) counter->next)
+   {
+      fprintf(out, "%.*s %lld\n", DYNINST_SHARDED_COUNTER_NAME_LEN,
+              counter->name, (long long) DYNINST_shardedCounterTotal(counter));
+   }
+   tc_lock_unlock(&DYNINST_counter_lock);
+
+   if (out != stderr)
+      fclose(out);
+   else
+      fflush(out);
+}
+
+/**
+ * Sampling guard.  Each thread keeps its own countdown of invocations to
+ * skip, so the common case is a TLS decrement with no shared writes.  The
+ * random generator is seeded per thread from the address of its TLS block
+ * and a global sequence number.
+ **/
+static TLS_VAR unsigned DYNINST_tls_sample_countdown = 0;
+static TLS_VAR unsigned DYNINST_tls_sample_seed = 0;
+static volatile unsigned DYNINST_sample_seq = 0;
+
+static unsigned nextSamplingInterval(DYNINST_samplingConfig_t *config)
+{
+   unsigned period = config->period;
+   unsigned x;
+   uint64_t range;
+
+   if (period <= 1) return 1;
+   if (!config->randomize) return period;
+
+   x = DYNINST_tls_sample_seed;
+   if (!x) {
+#if defined(_MSC_VER)
+      x = (unsigned) InterlockedIncrement((volatile LONG *) &DYNINST_sample_seq);
+#else
+      x = __sync_add_and_fetch(&DYNINST_sample_seq, 1);
+#endif
+      x = x * 2654435761u ^ (unsigned) (unsigned long) &DYNINST_tls_sample_countdown;
+      if (!x) x = 1;
+   }
+   /* xorshift32 */
+   x ^= x << 13;
+   x ^= x >> 17;
+   x ^= x << 5;
+   DYNINST_tls_sample_seed = x;
+   /* The mutator keeps period within DYNINST_MAX_RANDOM_SAMPLING_PERIOD;
+    * clamp anyway so a bad config can't wrap the range. */
+   if (period > DYNINST_MAX_RANDOM_SAMPLING_PERIOD)
+      period = DYNINST_MAX_RANDOM_SAMPLING_PERIOD;
+   range = 2 * (uint64_t) period - 1;
+   return 1 + (unsigned) (x % range);
+}
+
+DLLEXPORT int DYNINST_sampleGuard(DYNINST_samplingConfig_t *config)
+{
+   unsigned countdown = DYNINST_tls_sample_countdown;
+
+   /* A countdown the current period could not have produced means the
+    * mutator lowered the period; start over rather than wait out the old
+    * interval. */
+   if (countdown > 1 && countdown <= 2 * (uint64_t) config->period) {
+      DYNINST_tls_sample_countdown = countdown - 1;
+      return 0;
+   }
+   DYNINST_tls_sample_countdown = nextSamplingInterval(config);
+   return 1;
+}
+
 int tc_lock_init(tc_lock_t *t)
 {
   t->mutex = 0;
@@ -684,11 +873,12 @@ DLLEXPORT volatile unsigned long dyninstTrapTableVersion;
 DLLEXPORT volatile trapMapping_t *dyninstTrapTable;
 DLLEXPORT volatile unsigned long dyninstTrapTableIsSorted;
 
-void* dyninstTrapTranslate(void *source,
-                           volatile unsigned long *table_used,
-                           volatile unsigned long *table_version,
-                           volatile trapMapping_t **trap_table,
-                           volatile unsigned long *is_sorted)
+static void* trapTableLookup(void *source,
+                             volatile unsigned long *table_used,
+                             volatile unsigned long *table_version,
+                             volatile trapMapping_t **trap_table,
+                             volatile unsigned long *is_sorted,
+                             unsigned *index)
 {
    volatile unsigned local_version;
    unsigned i;
@@ -697,6 +887,7 @@ void* dyninstTrapTranslate(void *source,
    do {
       local_version = *table_version;
       target = NULL;
+      *index = (unsigned) -1;
 
       if (*is_sorted)
       {
@@ -721,6 +912,7 @@ void* dyninstTrapTranslate(void *source,
                max = mid;
             else {
                target = (*trap_table)[mid].target;
+               *index = mid;
                break;
             }
          }
@@ -729,6 +921,7 @@ void* dyninstTrapTranslate(void *source,
          for (i = 0; i<*table_used; i++) {
             if ((*trap_table)[i].source == source) {
                target = (*trap_table)[i].target;
+               *index = i;
                break;
             }
          }
@@ -738,6 +931,126 @@ void* dyninstTrapTranslate(void *source,
    return target;
 }
 
+/**
+ * Per-thread translation cache in front of the trap table.  Every indirect
+ * branch that lands on a trap in original code comes through here, so hot
+ * targets are remembered in a direct-mapped table indexed by a hash of the
+ * source address.  An entry remembers which table and which slot of it
+ * matched rather than the target itself: a hit must name the table the
+ * caller passed in, carry its current version, and still find the source
+ * in that slot, and the target is then read from the table.  Static-mode
+ * tables always report version 0 and can be replaced in place when a
+ * library is unloaded and another loaded at the same address, so the slot
+ * check is what keeps them from returning stale targets.  The table is
+ * allocated on first use with mmap, which unlike malloc is safe in the
+ * trap handler, only its pointer lives in static TLS, and it is released
+ * when the thread exits.
+ **/
+#define TRAP_CACHE_SIZE 1024 /* power of two */
+
+typedef struct {
+   void *source;
+   volatile trapMapping_t *table;
+   unsigned long version;
+   unsigned index;
+} trapCacheEntry_t;
+
+static TLS_VAR trapCacheEntry_t *DYNINST_tls_trap_cache = NULL;
+
+#if !defined(os_windows)
+/* Only used if the application links libpthread */
+#pragma weak pthread_key_create
+#pragma weak pthread_setspecific
+
+static pthread_key_t DYNINST_trap_cache_key;
+static volatile int DYNINST_trap_cache_key_state = 0; /* 0 none, 1 busy, 2 ready, -1 none possible */
+
+static void freeTrapCache(void *cache)
+{
+   if (cache == (void *) DYNINST_tls_trap_cache)
+      DYNINST_tls_trap_cache = NULL;
+   munmap(cache, TRAP_CACHE_SIZE * sizeof(trapCacheEntry_t));
+}
+
+/* Arrange for freeTrapCache to run when this thread exits.  Neither call
+ * allocates for the first few keys of a process, which is what makes
+ * this acceptable in the trap handler. */
+static void registerTrapCache(trapCacheEntry_t *cache)
+{
+   int state = DYNINST_trap_cache_key_state;
+   if (state == 0) {
+      if (__sync_bool_compare_and_swap(&DYNINST_trap_cache_key_state, 0, 1)) {
+         state = (pthread_key_create &&
+                  pthread_key_create(&DYNINST_trap_cache_key, freeTrapCache) == 0) ? 2 : -1;
+         DYNINST_trap_cache_key_state = state;
+      }
+      else {
+         while ((state = DYNINST_trap_cache_key_state) == 1);
+      }
+   }
+   if (state == 2 && pthread_setspecific)
+      pthread_setspecific(DYNINST_trap_cache_key, cache);
+}
+#endif
+
+static trapCacheEntry_t *getTrapCache()
+{
+   trapCacheEntry_t *cache = DYNINST_tls_trap_cache;
+   if (cache) return cache;
+#if defined(os_windows)
+   cache = (trapCacheEntry_t *) calloc(TRAP_CACHE_SIZE, sizeof(trapCacheEntry_t));
+#else
+   cache = (trapCacheEntry_t *) mmap(NULL, TRAP_CACHE_SIZE * sizeof(trapCacheEntry_t),
+                                     PROT_READ | PROT_WRITE,
+                                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+   if (cache == (trapCacheEntry_t *) MAP_FAILED) return NULL;
+   registerTrapCache(cache);
+#endif
+   DYNINST_tls_trap_cache = cache;
+   return cache;
+}
+
+void* dyninstTrapTranslate(void *source,
+                           volatile unsigned long *table_used,
+                           volatile unsigned long *table_version,
+                           volatile trapMapping_t **trap_table,
+                           volatile unsigned long *is_sorted)
+{
+   trapCacheEntry_t *cache = getTrapCache();
+   trapCacheEntry_t *entry;
+   volatile trapMapping_t *table;
+   unsigned long version;
+   unsigned long hash;
+   unsigned index;
+   void *target;
+
+   if (!cache)
+      return trapTableLookup(source, table_used, table_version,
+                             trap_table, is_sorted, &index);
+
+   hash = (unsigned long) source;
+   hash ^= hash >> 12;
+   entry = &cache[hash & (TRAP_CACHE_SIZE - 1)];
+   version = *table_version;
+   table = *trap_table;
+   if (entry->source == source && entry->table == table &&
+       entry->version == version && entry->index < *table_used &&
+       table[entry->index].source == source)
+   {
+      target = table[entry->index].target;
+      if (version == *table_version)
+         return target;
+   }
+
+   target = trapTableLookup(source, table_used, table_version,
+                            trap_table, is_sorted, &index);
+   entry->source = source;
+   entry->table = *trap_table;
+   entry->version = version;
+   entry->index = index;
+   return target;
+}
+
 DLLEXPORT void DYNINSTtrapFunction(){
    __asm__ __volatile__(
            "nop\n"
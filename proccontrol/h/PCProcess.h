@@ -42,6 +42,7 @@
 #include "EventType.h"
 #include "util.h"
 #include "PCErrors.h"
+#include "MachSyscall.h"
 #include "boost/checked_delete.hpp"
 #include "boost/shared_ptr.hpp"
 #include "boost/weak_ptr.hpp"
@@ -69,6 +70,7 @@ class int_iRPC;
 class int_notify;
 class HandlerPool;
 class MTLock;
+class response;
 
 #define PC_VERSION_8_0_0
 #define PC_VERSION_8_1_0
@@ -284,6 +286,45 @@ class PC_EXPORT IRPC
    bool continueStoppedIRPC();
 };
 
+/**
+ * An AsyncRequest is the completion handle for a memory or register
+ * operation started with one of the start* methods on Process or Thread.
+ * The operation is posted to the target when the handle is created; the
+ * caller may issue more requests, do other work, and later poll isReady()
+ * or block in wait().  ProcessSet::waitForAll waits on a batch of handles
+ * at once, so independent reads against several processes or threads
+ * overlap instead of paying one round trip each.
+ *
+ * Any buffer or RegisterPool passed to the start* call must stay valid
+ * until the request completes, or until its handle is destroyed.
+ * Destroying a handle whose request is still in flight does not wait;
+ * the request finishes in the background and its result is discarded.
+ **/
+class PC_EXPORT AsyncRequest
+{
+   friend class Process;
+   friend class Thread;
+   friend class ProcessSet;
+   friend void boost::checked_delete<AsyncRequest>(AsyncRequest *) CHECKED_DELETE_NOEXCEPT;
+   friend void boost::checked_delete<const AsyncRequest>(const AsyncRequest *) CHECKED_DELETE_NOEXCEPT;
+ private:
+   boost::shared_ptr< ::response> resp_;
+   AsyncRequest(boost::shared_ptr< ::response> resp);
+   ~AsyncRequest();
+ public:
+   typedef boost::shared_ptr<AsyncRequest> ptr;
+   typedef boost::shared_ptr<const AsyncRequest> const_ptr;
+
+   //Returns true if the request has completed, without blocking.
+   bool isReady() const;
+
+   //Blocks until the request completes.  Returns false if it failed.
+   bool wait() const;
+
+   //True if the request completed with an error.
+   bool hasError() const;
+};
+
 class PC_EXPORT Process : public boost::enable_shared_from_this<Process>
 {
  private:
@@ -332,6 +373,19 @@ class PC_EXPORT Process : public boost::enable_shared_from_this<Process>
                                      const std::vector<std::string> &argv,
                                      const std::vector<std::string> &envp = emptyEnvp,
                                      const std::map<int,int> &fds = emptyFDs);
+   /**
+    * As above, but the new process only stops for pre- and post-syscall
+    * events on the listed syscalls, rather than on every syscall as with
+    * Thread::setSyscallMode.  The filter is installed with seccomp-bpf just
+    * before the process execs and cannot be changed or removed once it is
+    * running.  Forked children inherit it.  An empty filter disables
+    * filtering.  Only supported on Linux.
+    **/
+   static Process::ptr createProcess(std::string executable,
+                                     const std::vector<std::string> &argv,
+                                     const std::vector<MachSyscall> &syscall_filter,
+                                     const std::vector<std::string> &envp = emptyEnvp,
+                                     const std::map<int,int> &fds = emptyFDs);
    static Process::ptr attachProcess(Dyninst::PID pid, std::string executable = "");
 
    /**
@@ -475,6 +529,15 @@ class PC_EXPORT Process : public boost::enable_shared_from_this<Process>
    bool writeMemoryAsync(Dyninst::Address addr, const void *buffer, size_t size, void *opaque_val = NULL) const;
    bool readMemoryAsync(void *buffer, Dyninst::Address addr, size_t size, void *opaque_val = NULL) const;
 
+   /**
+    * Future-style variants of readMemoryAsync/writeMemoryAsync.  These
+    * return a handle rather than delivering an EventAsyncRead/Write
+    * callback, and return an empty pointer if the request could not be
+    * posted.
+    **/
+   AsyncRequest::ptr startReadMemory(void *buffer, Dyninst::Address addr, size_t size) const;
+   AsyncRequest::ptr startWriteMemory(Dyninst::Address addr, const void *buffer, size_t size) const;
+
    /** 
     * Currently Windows-only, needed for the test infrastructure but possibly useful elsewhere 
     **/
@@ -521,6 +584,18 @@ class PC_EXPORT Process : public boost::enable_shared_from_this<Process>
     **/
 	bool runIRPCAsync(IRPC::ptr irpc);
 
+   /**
+    * Post a sequence of IRPCs to a single thread and run them in order,
+    * waiting for all of them to complete.  The application's registers
+    * are saved before the first IRPC and restored after the last, rather
+    * than around each one, and the IRPCs share one code allocation.
+    * This is not a single stop: each IRPC still ends in its own trap,
+    * delivers its own callback, and the thread is continued again for
+    * the next one.  Later IRPCs start with the registers left by the
+    * previous one (other than the PC).  There is no ProcessSet form.
+    **/
+   bool runIRPCSequenceSync(const std::vector<IRPC::ptr> &irpcs);
+
    /**
     * Symbol access
     **/
@@ -529,6 +604,11 @@ class PC_EXPORT Process : public boost::enable_shared_from_this<Process>
    static SymbolReaderFactory *getDefaultSymbolReader();
    static void setDefaultSymbolReader(SymbolReaderFactory *reader);
 
+   /**
+    * True if this process was created with a syscall filter
+    **/
+   bool hasSyscallFilter() const;
+
    /**
     * Perform specific operations.  Interface objects will only be returned
     * on appropriately supported platforms, others will return NULL.
@@ -612,6 +692,8 @@ class PC_EXPORT Thread : public boost::enable_shared_from_this<Thread>
    bool setAllRegisters(RegisterPool &pool) const;
    bool getAllRegistersAsync(RegisterPool &pool, void *opaque_val = NULL) const;
    bool setAllRegistersAsync(RegisterPool &pool, void *opaque_val = NULL) const;
+   AsyncRequest::ptr startGetAllRegisters(RegisterPool &pool) const;
+   AsyncRequest::ptr startSetAllRegisters(RegisterPool &pool) const;
 
    bool readThreadLocalMemory(void *buffer, Library::const_ptr lib, Dyninst::Offset tls_symbol_offset, size_t size) const;
    bool writeThreadLocalMemory(Library::const_ptr lib, Dyninst::Offset tls_symbol_offset, const void *buffer, size_t size) const;
@@ -0,0 +1,103 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#if !defined(PCSTATS_H_)
+#define PCSTATS_H_
+
+#include <string>
+#include <map>
+
+#include "util.h"
+
+namespace Dyninst {
+namespace ProcControlAPI {
+
+/**
+ * Low-overhead instrumentation of ProcControlAPI itself.  When enabled,
+ * ProcControl records how long each handler and each event takes to
+ * handle, how deep the event mailbox gets, how many ptrace calls it makes
+ * and how long ProcessSet::stopProcs takes.  Nothing is recorded until
+ * enable(true) is called, or DYNINST_PROCCONTROL_STATS is set in the
+ * environment.
+ *
+ * Tracing additionally keeps a timeline of every handler invocation, which
+ * writeTrace saves in the Chrome trace event format (loadable by
+ * chrome://tracing or Perfetto).  If DYNINST_PROCCONTROL_TRACE names a
+ * file, tracing is enabled at startup and the file is written at exit.
+ **/
+class PC_EXPORT ProcStats
+{
+  public:
+   //Latencies are kept in power-of-two microsecond buckets.  buckets[0]
+   // counts latencies under 1us, and buckets[i] those in [2^(i-1), 2^i)
+   // usec.  The last bucket also holds everything longer.
+   static const unsigned NumBuckets = 24;
+
+   struct PC_EXPORT Histogram {
+      Histogram();
+      void add(unsigned long usecs);
+
+      unsigned long count;
+      unsigned long total_usecs;
+      unsigned long max_usecs;
+      unsigned long buckets[NumBuckets];
+   };
+
+   struct PC_EXPORT Snapshot {
+      Snapshot();
+
+      //Time for a HandlerPool to handle an event and its subservient
+      // events, keyed by event type name
+      std::map<std::string, Histogram> event_latency;
+      //Time spent in each handler, keyed by handler name
+      std::map<std::string, Histogram> handler_latency;
+      //Time for ProcessSet::stopProcs to stop the whole set
+      Histogram stop_latency;
+
+      unsigned long events_enqueued;
+      unsigned long max_mailbox_depth;
+      unsigned long ptrace_calls;
+   };
+
+   static void enable(bool b);
+   static bool isEnabled();
+
+   static void getSnapshot(Snapshot &snapshot);
+   static void reset();
+
+   static void enableTrace(bool b);
+   static bool isTraceEnabled();
+   static bool writeTrace(std::string filename);
+};
+
+}
+}
+
+#endif
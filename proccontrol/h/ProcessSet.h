@@ -55,6 +55,7 @@ class LWPTrackingSet;
 class RemoteIOSet;
 class MemoryUsageSet;
 class PSetFeatures;
+class PSetLatency;
 class TSetFeatures;
 
 typedef boost::shared_ptr<ProcessSet> ProcessSet_ptr;
@@ -166,6 +167,7 @@ class PC_EXPORT ProcessSet : public boost::enable_shared_from_this<ProcessSet>
   private:
    int_processSet *procset;
    PSetFeatures *features;
+   PSetLatency *latency;
 
    ProcessSet();
    ~ProcessSet();
@@ -200,6 +202,7 @@ class PC_EXPORT ProcessSet : public boost::enable_shared_from_this<ProcessSet>
       std::vector<std::string> argv;
       std::vector<std::string> envp;
       std::map<int, int> fds;
+      std::vector<MachSyscall> syscall_filter; //See Process::createProcess
       ProcControlAPI::err_t error_ret; //Set on return
       Process::ptr proc;               //Set on return
    };
@@ -213,6 +216,13 @@ class PC_EXPORT ProcessSet : public boost::enable_shared_from_this<ProcessSet>
    };
    static ProcessSet::ptr attachProcessSet(std::vector<AttachInfo> &ainfo);
 
+   /**
+    * Block until every request in reqs has completed.  Requests may target
+    * any mix of processes and threads; their target round trips overlap.
+    * Returns false if any request failed; check each one's hasError().
+    **/
+   static bool waitForAll(const std::vector<AsyncRequest::ptr> &reqs);
+
    /**
     * Return a new set by performing these set operations with another set.
     **/
@@ -330,6 +340,14 @@ class PC_EXPORT ProcessSet : public boost::enable_shared_from_this<ProcessSet>
    bool temporaryDetach() const;
    bool reAttach() const;
 
+   /**
+    * Wall-clock time, in microseconds, that the most recent successful
+    * stopProcs call on this set took to bring every thread to a stop, and
+    * that the most recent continueProcs call took to issue its continues.
+    **/
+   unsigned long getLastStopLatency() const;
+   unsigned long getLastContinueLatency() const;
+
    /**
     * Memory management
     **/
@@ -543,6 +561,16 @@ class PC_EXPORT ThreadSet : public boost::enable_shared_from_this<ThreadSet> {
    bool getAllRegisters(std::map<Thread::ptr, RegisterPool> &results) const;
    bool setAllRegisters(const std::map<Thread::const_ptr, RegisterPool> &reg_vals) const;
 
+   /**
+    * Fetch a selected set of registers from every thread.  Each thread's
+    * result vector holds the values in the same order as regs.  The whole
+    * register file is read with one request per thread and kept until
+    * that thread is next continued, so repeated calls on stopped threads
+    * (e.g. reading PC/SP/FP for each sample) do not go back to the OS.
+    **/
+   bool getRegisters(const std::vector<Dyninst::MachRegister> &regs,
+                     std::map<Thread::ptr, std::vector<Dyninst::MachRegisterVal> > &results) const;
+
    /**
     * IRPC
     * The user may pass multiple IRPCs, which are posted to their respective threads.
@@ -0,0 +1,54 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#if !defined(INT_PCSTATS_H_)
+#define INT_PCSTATS_H_
+
+#include <string>
+#include <boost/atomic.hpp>
+#include "PCStats.h"
+
+//Recording hooks behind ProcStats.  Callers test pcstats_enabled first,
+// so disabled statistics cost one atomic load and a branch.  The hooks
+// test it again, so none of them takes a lock while disabled.
+extern boost::atomic<bool> pcstats_enabled;
+extern boost::atomic<bool> pcstats_tracing;
+
+//Microseconds on a monotonic clock
+unsigned long long pcstats_now();
+
+void pcstats_handler(const std::string &handler, const std::string &event, int pid,
+                     unsigned long long start, unsigned long long end);
+void pcstats_event(const std::string &event, unsigned long usecs);
+void pcstats_stop(unsigned long usecs);
+void pcstats_enqueue(unsigned long depth);
+void pcstats_ptrace();
+
+#endif
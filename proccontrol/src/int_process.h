@@ -474,6 +474,12 @@ class int_process
    virtual bool plat_getOSRunningStates(std::map<Dyninst::LWP, bool> &runningStates) = 0;
 	// Windows-only technically
    virtual void* plat_getDummyThreadHandle() const { return NULL; }
+   //True if syscall events on this process are limited to a filtered set
+   virtual bool plat_hasSyscallFilter() const { return false; }
+   //Sets the syscalls that a process about to be created stops on.  Returns
+   // false if the platform cannot filter syscalls.
+   virtual bool plat_setSyscallFilter(const std::vector<unsigned long> &) { return false; }
+   bool setSyscallFilter(const std::vector<MachSyscall> &syscalls);
 
    virtual void noteNewDequeuedEvent(Event::ptr ev);
 
@@ -488,6 +494,9 @@ class int_process
    virtual bool plat_supportDOTF();
 
    virtual bool plat_supportThreadEvents();
+   //Lets platforms fill in user thread info for all threads at once
+   // before a query that visits every thread
+   virtual void plat_prefetchUserThreadInfo();
    virtual bool plat_supportLWPCreate();
    virtual bool plat_supportLWPPreDestroy();
    virtual bool plat_supportLWPPostDestroy();
@@ -977,7 +986,7 @@ public:
    }
 
    //Register Management
-   bool getAllRegisters(allreg_response::ptr result);
+   bool getAllRegisters(allreg_response::ptr result, bool allow_cached = false);
    bool getRegister(Dyninst::MachRegister reg, reg_response::ptr result);
    bool setAllRegisters(int_registerPool &pool, result_response::ptr result);
    bool setRegister(Dyninst::MachRegister reg, Dyninst::MachRegisterVal val, result_response::ptr result);
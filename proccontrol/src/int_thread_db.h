@@ -107,6 +107,7 @@ public:
     virtual async_ret_t post_create(std::set<response::ptr> &async_responses);
 
     virtual bool plat_supportThreadEvents();
+    virtual void plat_prefetchUserThreadInfo();
 
     // Platform-dependent functionality (derived classes override)
     virtual bool plat_getLWPInfo(lwpid_t lwp, void *lwpInfo);
@@ -142,6 +143,8 @@ public:
                                               size_t offset, void **address);
     typedef td_err_e (*td_thr_tlsbase_t)(const td_thrhandle_t *, unsigned long modid,
                                          void **address);
+    typedef td_err_e (*td_ta_thr_iter_t)(const td_thragent_t *, td_thr_iter_f *, void *,
+                                         td_thr_state_e, int, sigset_t *, unsigned int);
 
     //Function pointers to the thread_db functions
     static bool loadedThreadDBLibrary();
@@ -160,6 +163,28 @@ public:
     static td_thr_dbresume_t p_td_thr_dbresume;
     static td_thr_tls_get_addr_t p_td_thr_tls_get_addr;
     static td_thr_tlsbase_t p_td_thr_tlsbase;
+    //Optional, NULL if this libthread_db doesn't provide it
+    static td_ta_thr_iter_t p_td_ta_thr_iter;
+
+    //While a bulk read is active, thread_db's reads of the target are
+    // served from whole pages that are each read once, rather than with
+    // one small read per field of each thread descriptor.  Only used on
+    // platforms with synchronous memory access.  Any write through
+    // thread_db drops the cached pages.
+    void beginBulkRead();
+    void endBulkRead();
+    bool bulkReadActive() const { return bulk_read_depth > 0; }
+    bool bulkRead(void *local, Dyninst::Address remote, size_t size);
+    void invalidateBulkRead();
+
+    //Fills in the user thread info of every thread that lacks it with one
+    // walk of the thread list.  Used at attach and for whole-set queries;
+    // threads created later fetch their own info individually.
+    bool refreshThreadInfo();
+
+    //Statistics on time spent in thread_db, reported after initialization
+    void noteThreadDBRead() { tdb_read_count++; }
+    void addThreadDBTime(unsigned long usecs) { tdb_usecs += usecs; }
 
 protected:
     Event::ptr decodeThreadEvent(td_event_msg_t *eventMsg, bool &async);
@@ -195,6 +220,14 @@ private:
 
     std::set<int_library *> libs_with_cached_tls_areas;
 
+    int bulk_read_depth;
+    std::map<Dyninst::Address, std::vector<char> > bulk_pages;
+    std::set<std::string> refresh_known_handles;
+    unsigned long tdb_read_count;
+    unsigned long tdb_page_reads;
+    unsigned long tdb_usecs;
+
+    static int refreshThreadInfoCB(const td_thrhandle_t *th, void *arg);
     async_ret_t ll_fetchThreadInfo(td_thrhandle_t *th, td_thrinfo_t *info);
 };
 
@@ -184,6 +184,13 @@ class int_iRPC : public boost::enable_shared_from_this<int_iRPC>
    void setDirectFree(bool s) { directFree_ = s; }
    bool directFree() const { return directFree_; }
 
+   //Batched RPCs run back-to-back on one thread; registers are only
+   // restored once the last RPC of the batch finishes.  Members of one
+   // batch share an ID, and 0 means the RPC is not batched.
+   void setBatchID(unsigned long id) { batch_id = id; }
+   unsigned long batchID() const { return batch_id; }
+   static unsigned long newBatchID() { return ++next_batch_id; }
+
    void getPendingResponses(std::set<response::ptr> &resps);
    void syncAsyncResponses(bool is_sync);
 
@@ -199,6 +206,7 @@ class int_iRPC : public boost::enable_shared_from_this<int_iRPC>
    void setRestoreToState(int_thread::State s);
  private:
    static unsigned long next_id;
+   static unsigned long next_batch_id;
    unsigned long my_id;
    State state;
    Type type;
@@ -222,6 +230,7 @@ class int_iRPC : public boost::enable_shared_from_this<int_iRPC>
    result_response::ptr rpcwrite_result;
    result_response::ptr pcset_result;
    bool directFree_;
+   unsigned long batch_id;
    void *user_data;
 };
 
@@ -239,6 +248,8 @@ class iRPCMgr
    
    bool postRPCToProc(int_process *proc, int_iRPC::ptr rpc);
    bool postRPCToThread(int_thread *thread, int_iRPC::ptr rpc);
+   //Takes a posted, not yet running iRPC back off its thread's queue
+   bool removePostedRPC(int_thread *thread, int_iRPC::ptr rpc);
    int_thread *createThreadForRPC(int_process* proc, int_thread* best_candidate);
 
    int_iRPC::ptr createInfMallocRPC(int_process *proc, unsigned long size, bool use_addr, Dyninst::Address addr);
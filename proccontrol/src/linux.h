@@ -67,6 +67,7 @@ class GeneratorLinux : public GeneratorMT
    virtual bool initialize();
    virtual bool canFastHandle();
    virtual ArchEvent *getEvent(bool block);
+   virtual bool getMultiEvent(bool block, std::vector<ArchEvent *> &events);
    void evictFromWaitpid();
 };
 
@@ -156,8 +157,20 @@ class linux_process : public sysv_process, public unix_process, public thread_db
    virtual bool plat_getResidentUsage(unsigned long stacku, unsigned long heapu, unsigned long sharedu,
                                       MemUsageResp_t *resp);
 
+   //True if this process was attached with PTRACE_SEIZE, in which case its
+   // threads are stopped with PTRACE_INTERRUPT rather than SIGSTOP.
+   bool ptraceSeized() const { return ptrace_seized; }
+
+   //Installs the seccomp filter for syscall_filter in the child before exec
+   virtual void plat_preExec();
+   virtual bool plat_hasSyscallFilter() const;
+   virtual bool plat_setSyscallFilter(const std::vector<unsigned long> &syscalls);
+
   protected:
    int computeAddrWidth();
+   bool ptrace_seized;
+   //Platform numbers of the syscalls that stop with PTRACE_EVENT_SECCOMP
+   std::vector<unsigned long> syscall_filter;
 };
 
 class linux_x86_process : public linux_process, public x86_process
@@ -234,9 +247,20 @@ class linux_thread : virtual public thread_db_thread
    virtual bool suppressSanityChecks();
 
    void setGeneratorExiting() { generator_started_exit_processing = true; }
+
+   //Set after a filtered syscall entry, so that the next continue uses
+   // PTRACE_SYSCALL and the matching syscall exit is reported.
+   void setFilteredSyscallExitPending(bool b) { filtered_syscall_exit_pending = b; }
+   bool filteredSyscallExitPending() const { return filtered_syscall_exit_pending; }
+
+   //Set when our interrupt-stop was reported as an application group-stop
+   // on a seized thread, so the next plain continue uses PTRACE_LISTEN.
+   void setInGroupStop(bool b) { in_group_stop = b; }
  private:
    ArchEventLinux *postponed_syscall_event;
    bool generator_started_exit_processing;
+   bool filtered_syscall_exit_pending;
+   bool in_group_stop;
 };
 
 class linux_x86_thread : virtual public linux_thread, virtual public x86_thread
@@ -117,6 +117,10 @@ class response : public boost::enable_shared_from_this<response> {
    void markError(int code = 0);
    void markSyncHandled();
 
+   //The caller has abandoned this response.  It stays pending until the
+   // target answers, but no longer touches memory the caller owns.
+   virtual void detachFromCaller();
+
    void setEvent(Event::ptr ev);
    Event::ptr getEvent() const;
 
@@ -214,6 +218,7 @@ class allreg_response : public response
    friend void boost::checked_delete<const allreg_response>(const allreg_response *) CHECKED_DELETE_NOEXCEPT;
   private:
    int_registerPool *regpool;
+   int_registerPool *owned_regpool;
    int_thread *thr;
    reg_response::ptr indiv_access;
    Dyninst::MachRegister indiv_reg;
@@ -238,6 +243,8 @@ class allreg_response : public response
    reg_response::ptr getIndividualAcc();
 
    int_registerPool *getRegPool() const;
+
+   virtual void detachFromCaller();
 };
 
 class mem_response : public response
@@ -246,6 +253,7 @@ class mem_response : public response
    friend void boost::checked_delete<const mem_response>(const mem_response *) CHECKED_DELETE_NOEXCEPT;
   private:
    char *buffer;
+   char *owned_buffer;
    unsigned size;
    bool buffer_set;
    Address last_base;
@@ -271,6 +279,8 @@ class mem_response : public response
    void postResponse();
    void setLastBase(Address a);
    Address lastBase();
+
+   virtual void detachFromCaller();
 };
 
 class stack_response : public response
@@ -47,6 +47,10 @@ class unix_process : virtual public int_process
    virtual ~unix_process();
 
    virtual void plat_execv();
+   //Runs in the new child after its file descriptors are redirected and
+   // immediately before it execs the target.  Errors are reported with
+   // childExecFailed, as with a failed redirection.
+   virtual void plat_preExec();
    virtual bool post_forked();
    virtual unsigned getTargetPageSize();
 
@@ -68,6 +72,12 @@ class unix_process : virtual public int_process
    virtual bool plat_supportFork();
    virtual bool plat_supportExec();
 
+  protected:
+   //Runs in the new child when it cannot reach the exec.  Sends err back
+   // over exec_fail_fd, if the platform opened one, and exits the child.
+   void childExecFailed(err_t err);
+   int exec_fail_fd;
+
   private:
 
 };
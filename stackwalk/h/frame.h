@@ -35,6 +35,9 @@
 #include "Annotatable.h"
 #include <string>
 #include <set>
+#include <vector>
+#include <map>
+#include <ostream>
 
 class StackCallback;
 
@@ -210,6 +213,72 @@ class SW_EXPORT CallTree {
    frame_cmp_wrapper cmp_wrapper;
 };
 
+/**
+ * A CompactCallTree aggregates call stacks by (library, offset) instead
+ * of keeping a Frame in every node.  Library paths and function names are
+ * interned once per tree, stacks with a common prefix share nodes, and a
+ * node only carries counts, so trees built from very many threads stay
+ * small.  Per-thread identity is not kept.  Trees built separately, e.g.
+ * by parallel workers, are combined with merge.
+ **/
+class SW_EXPORT CompactCallTree {
+  public:
+   typedef unsigned node_id;
+   static const node_id root = 0;
+   static const unsigned none = (unsigned) -1;
+
+   struct Node {
+      node_id parent;
+      unsigned lib;             //Index into getLibraries(), or none
+      Dyninst::Offset offset;   //Offset into lib, or the address when lib is none
+      unsigned name;            //Index into getNames(), or none
+      unsigned long count;      //Stacks passing through this node
+      unsigned long self_count; //Stacks whose innermost frame is this node
+   };
+
+   CompactCallTree();
+
+   void addCallStack(const std::vector<Frame> &stk);
+   void merge(const CompactCallTree &other);
+
+   const std::vector<Node> &getNodes() const { return nodes; }
+   const std::vector<std::string> &getLibraries() const { return libs; }
+   const std::vector<std::string> &getNames() const { return names; }
+   unsigned long numStacks() const { return nodes[root].count; }
+
+   //Writes the tree as text, one record per line, without building any
+   // intermediate copy:
+   //   L <id> <library path>
+   //   N <id> <function name>
+   //   F <id> <parent> <lib> <offset> <name> <count> <self count>
+   //Node ids are dense and every parent is written before its children.
+   void serialize(std::ostream &out) const;
+
+  private:
+   struct child_key {
+      node_id parent;
+      unsigned lib;
+      Dyninst::Offset offset;
+      bool operator<(const child_key &k) const {
+         if (parent != k.parent) return parent < k.parent;
+         if (lib != k.lib) return lib < k.lib;
+         return offset < k.offset;
+      }
+   };
+
+   std::vector<Node> nodes;
+   std::vector<std::string> libs;
+   std::vector<std::string> names;
+   std::map<std::string, unsigned> lib_ids;
+   std::map<std::string, unsigned> name_ids;
+   std::map<child_key, node_id> children;
+
+   unsigned internLib(const std::string &s);
+   unsigned internName(const std::string &s);
+   node_id findChild(node_id parent, unsigned lib, Dyninst::Offset offset);
+   node_id newChild(node_id parent, unsigned lib, Dyninst::Offset offset, unsigned name);
+};
+
 }
 }
 
@@ -225,6 +225,12 @@ class SW_EXPORT AnalysisStepper : public FrameStepper {
    virtual void registerStepperGroup(StepperGroup *group);
    virtual ~AnalysisStepper();
    virtual const char *getName() const;
+
+   //Stack heights are analyzed once per call site and kept for the life
+   // of the process.  These save them to, and preload them from, a file
+   // so a new process can skip the analysis for unchanged libraries.
+   static bool saveAnalysisCache(std::string file);
+   static bool loadAnalysisCache(std::string file);
 };
 
 class SW_EXPORT DyninstDynamicHelper
@@ -61,7 +61,11 @@ protected:
    static std::map<Dyninst::PID, ProcessState *> proc_map;
    std::string executable_path;
 
-   ProcessState(Dyninst::PID pid_ = 0, std::string executable_path_ = std::string(""));
+   //track_pid is false for states that stand in for another ProcessState
+   // of the same pid (e.g. ProcSnapshot), so getProcessStateByPid keeps
+   // finding the original.
+   ProcessState(Dyninst::PID pid_ = 0, std::string executable_path_ = std::string(""),
+                bool track_pid = true);
    void setPid(Dyninst::PID pid_);
 public:
 
@@ -164,6 +168,53 @@ class SW_EXPORT ProcDebug : public ProcessState {
   virtual Dyninst::Architecture getArchitecture();
 };
 
+/**
+ * A ProcSnapshot holds the registers and a bounded copy of the stack of
+ * every thread in a ProcDebug process.  newProcSnapshot stops the process
+ * only long enough to take those copies (one bulk read per thread) and
+ * then resumes it.  A Walker created on the snapshot unwinds and
+ * symbolizes offline, so the target's pause time depends on the bytes
+ * copied rather than on stack depth or unwinding cost.
+ *
+ * Memory outside the captured stacks is served from the on-disk image of
+ * read-only library segments; other reads fail, which ends the walk at
+ * that frame.  Library information is shared with the source ProcDebug,
+ * which must outlive the snapshot.
+ **/
+class SW_EXPORT ProcSnapshot : public ProcessState {
+ private:
+  struct thread_snapshot {
+     std::map<Dyninst::MachRegister, Dyninst::MachRegisterVal> regs;
+     Dyninst::Address stack_base;
+     std::vector<unsigned char> stack;
+  };
+
+  ProcDebug *source;
+  std::map<Dyninst::THR_ID, thread_snapshot> thread_snaps;
+  Dyninst::THR_ID default_thread;
+  unsigned addr_width;
+  Dyninst::Architecture arch;
+
+  ProcSnapshot(ProcDebug *source_);
+  bool capture(size_t max_stack_bytes);
+  bool readFromFile(void *dest, Dyninst::Address source, size_t size);
+ public:
+  static ProcSnapshot *newProcSnapshot(ProcDebug *source, size_t max_stack_bytes = 256 * 1024);
+  virtual ~ProcSnapshot();
+
+  virtual bool getRegValue(Dyninst::MachRegister reg, Dyninst::THR_ID thread, Dyninst::MachRegisterVal &val);
+  virtual bool readMem(void *dest, Dyninst::Address source, size_t size);
+  virtual bool getThreadIds(std::vector<Dyninst::THR_ID> &threads);
+  virtual bool getDefaultThread(Dyninst::THR_ID &default_tid);
+  virtual unsigned getAddressWidth();
+  virtual Dyninst::Architecture getArchitecture();
+  virtual LibraryState *getLibraryTracker();
+  virtual bool isFirstParty();
+
+  //Total bytes of stack copied out of the target
+  size_t capturedBytes() const;
+};
+
 //LibAddrPair.first = path to library, LibAddrPair.second = load address
 typedef std::pair<std::string, Address> LibAddrPair;
 typedef enum { library_load, library_unload } lib_change_t;
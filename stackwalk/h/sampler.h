@@ -0,0 +1,100 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef SAMPLER_H_
+#define SAMPLER_H_
+
+#include "basetypes.h"
+#include <vector>
+#include <string>
+
+namespace Dyninst {
+namespace Stackwalker {
+
+class int_sampler;
+
+/**
+ * A Sampler collects call stacks of the current process from inside a
+ * profiling signal handler (e.g. SIGPROF).  Walker::walkStack allocates
+ * and may take locks, so it cannot be used there; takeSample instead
+ * unwinds from the interrupted context with a read-only table of CFI
+ * rows, falling back to the frame pointer chain where no simple row
+ * exists.  Every step is checked against the thread's stack bounds, and
+ * the raw PCs are copied into a buffer preallocated for that thread.
+ * Another thread later calls drainSamples and symbolize outside of signal
+ * context.
+ *
+ * The CFI table covers the objects loaded when the Sampler is created,
+ * and is rebuilt by registerThread if objects have been loaded or
+ * unloaded since.  Building it reads the CFI of every loaded object.
+ *
+ * Each thread must call registerThread before it is sampled.  Samples
+ * taken on unregistered threads, or when a thread's buffer is full, are
+ * counted by droppedSamples and discarded.
+ **/
+class SW_EXPORT Sampler {
+ private:
+   int_sampler *isampler;
+   Sampler(int_sampler *is);
+ public:
+   struct Sample {
+      Dyninst::THR_ID thread;
+      //Innermost frame first.  Every entry after the first is a return
+      // address, which points just past the call instruction.
+      std::vector<Dyninst::Address> pcs;
+   };
+
+   static Sampler *newSampler(unsigned max_depth = 64,
+                              unsigned samples_per_thread = 1024,
+                              unsigned max_threads = 256);
+   ~Sampler();
+
+   //Called on each thread to be sampled, outside of signal context.
+   bool registerThread();
+   void unregisterThread();
+
+   //Async-signal-safe.  context is the ucontext_t * passed as the third
+   // argument to an SA_SIGINFO handler.
+   bool takeSample(void *context);
+
+   //Moves every buffered sample into out.  Safe to call while other
+   // threads are being sampled.  Returns the number of samples moved.
+   unsigned drainSamples(std::vector<Sample> &out);
+
+   unsigned long droppedSamples() const;
+
+   //Looks up the function containing pc.  Not async-signal-safe.
+   bool symbolize(Dyninst::Address pc, std::string &name);
+};
+
+}
+}
+
+#endif
@@ -40,11 +40,13 @@ namespace Stackwalker {
 
 class FrameStepper;
 class Walker;
+class UnwindCache;
 
 class StepperGroup {
 protected:
    Walker *walker;
    std::set<FrameStepper *> steppers;
+   UnwindCache *unwind_cache;
 public:
    StepperGroup(Walker *new_walker);
    virtual ~StepperGroup();
@@ -57,6 +59,14 @@ public:
    virtual void registerStepper(FrameStepper *stepper);
    virtual void newLibraryNotification(LibAddrPair *libaddr, lib_change_t change);
    void getSteppers(std::set<FrameStepper *> &steppers);
+
+   //The PC-range cache of unwind results shared by all steppers in
+   // this group.  Hits count walks that a stepper completed straight from
+   // the cache; misses count walks where it had to be found by search.
+   UnwindCache *getUnwindCache() const;
+   void getUnwindCacheStats(const FrameStepper *stepper,
+                            unsigned long &hits, unsigned long &misses) const;
+   void clearUnwindCache();
 };
 
 class AddrRangeGroupImpl;
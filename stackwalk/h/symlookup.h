@@ -32,6 +32,9 @@
 #define SYMLOOKUP_H_
 
 #include <string>
+#include <vector>
+#include <map>
+#include <set>
 #include "basetypes.h"
 
 namespace Dyninst {
@@ -51,11 +54,24 @@ class SW_EXPORT SymbolLookup {
   virtual bool lookupAtAddr(Dyninst::Address addr, 
                             std::string &out_name, 
                             void* &out_value) = 0;
+
+  //Resolves many (library, offset) pairs at once.  out_names[i] is set to
+  // the name of addrs[i], or NULL if it could not be resolved.  Names are
+  // interned and stay valid for the life of this SymbolLookup, so equal
+  // names compare equal by pointer.  Offsets are looked up as given; to
+  // match Frame::getName pass a return address offset minus one.
+  // Returns false if any entry was left unresolved.
+  typedef std::pair<std::string, Dyninst::Offset> LibOffset;
+  virtual bool lookupBatch(const std::vector<LibOffset> &addrs,
+                           std::vector<const std::string *> &out_names);
   
   virtual Walker *getWalker();
   virtual ProcessState *getProcessState();
+ protected:
+  const std::string *internName(const std::string &name);
  private:
   std::string executable_path;
+  std::set<std::string> name_pool;
 };
 
 class SW_EXPORT SwkSymtab : public SymbolLookup {
@@ -73,7 +89,25 @@ class SymDefaultLookup : public SymbolLookup {
     virtual bool lookupAtAddr(Dyninst::Address addr, 
                               std::string &out_name, 
                               void* &out_value);
+    virtual bool lookupBatch(const std::vector<LibOffset> &addrs,
+                             std::vector<const std::string *> &out_names);
     virtual ~SymDefaultLookup();
+  private:
+    //Symbol ranges already resolved in one library, keyed by start offset.
+    // A NULL name records an offset with no symbol; offsets whose library
+    // could not be opened are not recorded.  The cache lives as long as
+    // the lookup, i.e. across all walks of the process, and is locked so
+    // walks on several threads can share it.
+    struct sym_range {
+       Dyninst::Offset end;
+       const std::string *name;
+    };
+    typedef std::map<Dyninst::Offset, sym_range> range_map;
+    std::map<std::string, range_map> sym_cache;
+
+    const std::string *resolve(const std::string &lib, range_map &ranges,
+                               Dyninst::Offset off, SymReader *&reader,
+                               bool &open_failed);
 };
 
 }
@@ -67,6 +67,7 @@ class Frame;
 class FrameStepper;
 class StepperGroup;
 class CallTree;
+class CompactCallTree;
 class int_walkerSet;
 
 class SW_EXPORT Walker {
@@ -193,6 +194,12 @@ class SW_EXPORT WalkerSet {
    size_t size() const;
 
    bool walkStacks(CallTree &tree, bool walk_initial_only = false) const;
+
+   //Walks every thread of every process, spreading the walkers over
+   // num_workers threads (0 picks one per hardware thread).  Each worker
+   // builds its own tree and the trees are merged into tree at the end.
+   // A Walker is only ever used by one worker at a time.
+   bool walkStacks(CompactCallTree &tree, unsigned num_workers = 0) const;
 };
 
 }
@@ -14,7 +14,7 @@ namespace Stackwalker {
 class aarch64_LookupFuncStart : public FrameFuncHelper
 {
 private:
-   static std::map<Dyninst::PID, aarch64_LookupFuncStart*> all_func_starts;
+   static std::map<ProcessState *, aarch64_LookupFuncStart*> all_func_starts;
    aarch64_LookupFuncStart(ProcessState *proc_);
    int ref_count;
 
@@ -35,8 +35,11 @@
 #include "dataflowAPI/h/stackanalysis.h"
 #include "dataflowAPI/h/Absloc.h"
 #include "SymReader.h"
+#include "common/h/concurrent.h"
 
 #include <string>
+#include <map>
+#include <set>
 
 namespace Dyninst {
 namespace ParseAPI {
@@ -69,9 +72,19 @@ class AnalysisStepperImpl : public FrameStepper
    virtual unsigned getPriority() const;  
    
    virtual const char *getName() const;
+
+   static bool saveHeightCache(std::string file);
+   static bool loadHeightCache(std::string file);
    
   protected:
    
+   //Stack heights already computed, by library and call site offset.
+   // Failed analyses are remembered too.  analysis_lock guards these and
+   // the parsing state below, which is shared by all walkers.
+   typedef std::map<Offset, std::set<height_pair_t> > height_map_t;
+   static std::map<std::string, height_map_t> height_cache;
+   static dyn_mutex analysis_lock;
+
    static std::map<std::string, ParseAPI::CodeObject *> objs;
    static std::map<std::string, ParseAPI::CodeSource*> srcs;
    static std::map<std::string, SymReader*> readers;
@@ -80,6 +93,7 @@ class AnalysisStepperImpl : public FrameStepper
    static ParseAPI::CodeSource *getCodeSource(std::string name);
 
    std::set<height_pair_t> analyzeFunction(std::string name, Offset off);
+   std::set<height_pair_t> computeHeights(std::string name, Offset off);
    std::vector<registerState_t> fullAnalyzeFunction(std::string name, Offset off);
    
    virtual bool isPrevInstrACall(Address addr, Address & target);
@@ -43,22 +43,13 @@ typedef boost::shared_ptr<DwarfFrameParser> DwarfFrameParserPtr;
 
 namespace Stackwalker {
 
+//Returns the (shared, cached) CFI parser for the named library
+DwarfDyninst::DwarfFrameParserPtr getAuxDwarfInfo(std::string s);
+
 class DebugStepperImpl : public FrameStepper, public Dyninst::ProcessReader {
  private:
-    struct cache_t {
-      unsigned ra_delta;
-      unsigned fp_delta;
-      unsigned sp_delta;
-      // Note: ra and fp are differences in address, sp is difference in value. 
-
-    cache_t() : ra_delta((unsigned) -1), fp_delta((unsigned) -1), sp_delta((unsigned) -1) {};
-    cache_t(unsigned a, unsigned b, unsigned c) : ra_delta(a), fp_delta(b), sp_delta(c) {};
-    };
-
-    dyn_hash_map<Address, cache_t> cache_;
-
+    //Publishes how cur was unwound to the StepperGroup's UnwindCache
     void addToCache(const Frame &cur, const Frame &caller);
-    bool lookupInCache(const Frame &cur, Frame &caller);
 
    Dyninst::Address last_addr_read;
    unsigned long last_val_read;
@@ -82,6 +73,11 @@ class DebugStepperImpl : public FrameStepper, public Dyninst::ProcessReader {
  protected:
   gcframe_ret_t getCallerFrameArch(Address pc, const Frame &in, Frame &out, 
                                    DwarfDyninst::DwarfFrameParserPtr dinfo, bool isVsyscallPage);
+  bool getCompactCallerFrame(Address pc, const Frame &in,
+                             DwarfDyninst::DwarfFrameParserPtr dinfo,
+                             MachRegisterVal &ret_value, location_t &ra_loc,
+                             MachRegisterVal &frame_value, location_t &fp_loc,
+                             MachRegisterVal &stack_value, location_t &sp_loc);
   bool isFrameRegister(MachRegister reg);
   bool isStackRegister(MachRegister reg);
 };
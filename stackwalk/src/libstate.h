@@ -35,6 +35,7 @@
 #include "common/h/SymReader.h"
 #include "stackwalk/h/procstate.h"
 #include "common/src/addrtranslate.h"
+#include "common/h/concurrent.h"
 #include <set>
 
 namespace Dyninst {
@@ -94,6 +95,7 @@ SymbolReaderFactory *getDefaultSymbolReader();
 class LibraryWrapper {
   private:
    std::map<std::string, SymReader *> file_map;
+   dyn_mutex lock;
   public:
    static SymReader *testLibrary(std::string filename);
    static SymReader *getLibrary(std::string filename);
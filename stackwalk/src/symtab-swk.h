@@ -39,6 +39,7 @@
 #include "stackwalk/h/procstate.h"
 #include "symtabAPI/h/AddrLookup.h"
 #include "symtabAPI/h/Function.h"
+#include "common/h/concurrent.h"
 #include <string>
 
 using namespace Dyninst::SymtabAPI;
@@ -50,6 +51,8 @@ class SymtabWrapper {
  private:
    dyn_hash_map<std::string, Symtab *> map;
    static SymtabWrapper *wrapper;
+   //Guards wrapper and map; walkers on different threads share them
+   static dyn_mutex wrapper_lock;
  protected:
    SymtabWrapper();
  public:
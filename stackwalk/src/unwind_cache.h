@@ -0,0 +1,105 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#if !defined(UNWIND_CACHE_H_)
+#define UNWIND_CACHE_H_
+
+#include "stackwalk/h/basetypes.h"
+#include "common/h/concurrent.h"
+#include <map>
+
+namespace Dyninst {
+namespace Stackwalker {
+
+class FrameStepper;
+
+/**
+ * How to get from a frame to its caller without asking the stepper again:
+ * CFA = (SP or FP) + cfa_offset, the return address is saved at
+ * CFA + ra_offset and the frame pointer either at CFA + fp_offset or not
+ * at all (unchanged).  The caller's SP is the CFA.
+ **/
+struct unwind_rule_t {
+   enum { cfa_sp, cfa_fp } cfa_base;
+   long cfa_offset;
+   long ra_offset;
+   bool fp_saved;
+   long fp_offset;
+};
+
+/**
+ * Per-StepperGroup cache of unwind results, keyed by non-overlapping PC
+ * ranges.  Each range remembers which stepper walked through it and,
+ * when the stepper could express it, the rule it used.  The Walker
+ * consults the cache before trying the steppers in priority order.
+ * Safe to use from several threads at once.
+ **/
+class UnwindCache {
+ public:
+   struct entry_t {
+      Address end;
+      FrameStepper *stepper;
+      bool has_rule;
+      unwind_rule_t rule;
+   };
+
+   UnwindCache();
+   ~UnwindCache();
+
+   bool lookup(Address pc, entry_t &out);
+   //Replaces any cached ranges that overlap [start, end)
+   void insert(Address start, Address end, FrameStepper *stepper,
+               const unwind_rule_t *rule = NULL);
+   void invalidate(Address start, Address end);
+   void clear();
+
+   void recordHit(const FrameStepper *stepper);
+   void recordMiss(const FrameStepper *stepper);
+   void getStats(const FrameStepper *stepper, unsigned long &hits, unsigned long &misses);
+
+ private:
+   typedef std::map<Address, entry_t> range_map_t;
+   range_map_t ranges;
+   dyn_rwlock ranges_lock;
+
+   struct stats_t {
+      unsigned long hits;
+      unsigned long misses;
+   };
+   std::map<const FrameStepper *, stats_t> stats;
+   dyn_mutex stats_lock;
+
+   void eraseOverlapping(Address start, Address end);
+};
+
+}
+}
+
+#endif
@@ -36,6 +36,7 @@
 #include "common/h/dyntypes.h"
 
 #include "common/src/lru_cache.h"
+#include "common/h/concurrent.h"
 
 namespace Dyninst {
 namespace Stackwalker {
@@ -61,7 +62,8 @@ class StepperWandererImpl : public FrameStepper {
 class LookupFuncStart : public FrameFuncHelper
 {
 private:
-   static std::map<Dyninst::PID, LookupFuncStart*> all_func_starts;
+   static std::map<ProcessState *, LookupFuncStart*> all_func_starts;
+   static dyn_mutex all_func_starts_lock;  // also guards ref_count
    LookupFuncStart(ProcessState *proc_);
    int ref_count;
 
@@ -71,6 +73,7 @@ private:
    // globally turn this caching on, but it would sure help things.
    static const unsigned int cache_size = 64;
    LRUCache<Address, alloc_frame_t> cache;
+   dyn_mutex cache_lock;
 public:
    static LookupFuncStart *getLookupFuncStart(ProcessState *p);
    void releaseMe();
@@ -96,6 +96,19 @@ class SYMTAB_EXPORT typeCollection : public Serializable//, public AnnotatableSp
     static dyn_c_hash_map< void *, typeCollection * > fileToTypesMap;
     static bool doDeferredLookups(typeCollection *);
 
+    /* Named aggregates, enums and typedefs are repeated in every compile
+       unit that includes their definition.  Once a module is parsed its
+       copies are folded onto a single process-wide instance when their
+       layouts match all the way down; within one Symtab, C++ modules may
+       also merge by name and layout, as the ODR allows.  Entries are keyed
+       by a digest of the layout and checked against it on use.  Types that
+       still reference an unknown type are never shared, so a shared type
+       is frozen: no module's fixupUnknowns can change it. */
+    static dyn_c_hash_map< size_t, boost::weak_ptr<Type> > canonicalTypes;
+    static boost::atomic<unsigned long> mergedTypeCount;
+    typedef dyn_hash_map<std::string, boost::shared_ptr<Type> > odrTypes_t;
+    unsigned canonicalizeTypes(odrTypes_t &odrTypes, bool odr);
+
     // DWARF...
     bool dwarfParsed_;
 
@@ -169,6 +182,9 @@ public:
       return r;
     }
     void clearNumberedTypes();
+
+    /* Number of duplicate types merged away by canonicalization */
+    static unsigned long getMergedTypeCount() { return mergedTypeCount.load(); }
     private:
         boost::mutex placeholder_mutex; // The only intermodule contention should be around
         // typedefs/other placeholders, but we'll go ahead and lock around type add operations
@@ -171,6 +171,8 @@ class SYMTAB_EXPORT Symbol : public Serializable,
 			 int index= -1,
 			 int strindex = -1,
                          bool cs = false);
+   Symbol(const Symbol &s);
+   Symbol &operator=(const Symbol &s);
    ~Symbol();
 
    bool          operator== (const Symbol &) const;
@@ -181,6 +183,10 @@ class SYMTAB_EXPORT Symbol : public Serializable,
    std::string      getMangledName () const;
    std::string	 getPrettyName() const;
    std::string      getTypedName() const;
+   // The mangled name without a copy; NUL-terminated and valid for the
+   // life of the symbol or until its name is changed.
+   const char *     getMangledNameCStr() const { return name_; }
+   std::size_t      getMangledNameLength() const { return nameLen_; }
 
    Module *getModule() const { return module_; } 
    Symtab *getSymtab() const;
@@ -253,35 +259,47 @@ class SYMTAB_EXPORT Symbol : public Serializable,
 
    private:
 
+   // Fields are ordered largest first to keep the record compact; there
+   // can be millions of these per binary.
    Module*       module_;
-   SymbolType    type_;
-   int           internal_type_;
-   SymbolLinkage linkage_;
-   SymbolVisibility visibility_;
    Offset        offset_;
    Offset        ptr_offset_;  // Function descriptor offset.  Not available on all platforms.
    Offset        localTOC_;
    Region*       region_;
    Symbol* 	 referring_;
-   unsigned      size_;  // size of this symbol. This is NOT available on all platforms.
-
-   bool          isDynamic_;
-   bool          isAbsolute_;
-   bool          isDebug_;
-
    Aggregate *   aggregate_; // Pointer to Function or Variable container, if appropriate.
 
-   std::string mangledName_;
+   // The mangled name, always NUL-terminated.  Names parsed from an ELF
+   // string table point straight into the mapped file (see
+   // setMangledNameView); any other name, including the name of a copied
+   // symbol, is owned by this symbol.
+   const char *  name_;
+   unsigned      nameLen_;
 
-   SymbolTag     tag_;
+   unsigned      size_;  // size of this symbol. This is NOT available on all platforms.
+   int           internal_type_;
    int index_;
    int strindex_;
 
-   bool          isCommonStorage_;
-
-   std::vector<std::string> verNames_;
+   SymbolType    type_;
+   SymbolLinkage linkage_;
+   SymbolVisibility visibility_;
+   SymbolTag     tag_;
 
-   bool versionHidden_;
+   bool          ownsName_ : 1;
+   bool          isDynamic_ : 1;
+   bool          isAbsolute_ : 1;
+   bool          isDebug_ : 1;
+   bool          isCommonStorage_ : 1;
+   bool          versionHidden_ : 1;
+
+   void setOwnedName(const char *name, std::size_t len);
+   void releaseName();
+   // name must be NUL-terminated and outlive the symbol, e.g. an entry in
+   // the string table of the file this symbol was parsed from.
+   void setMangledNameView(const char *name, std::size_t len);
+   // fileName is shared, e.g. the Object's version table, and not freed
+   bool setVersionFileNameRef(const std::string *fileName);
 
    void restore_module_and_region(SerializerBase *, 
 		   std::string &, Offset) THROW_SPEC (SerializerError);
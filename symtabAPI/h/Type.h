@@ -88,6 +88,9 @@ SYMTAB_EXPORT const char *dataClass2Str(dataClass dc);
 
 typedef int typeId_t;
 
+/* Maps a type that was merged away onto the one that replaces it */
+typedef dyn_hash_map<Type *, boost::shared_ptr<Type> > typeRemap_t;
+
 typedef enum {
    visPrivate, 
    visProtected, 
@@ -170,6 +173,9 @@ protected:
 
    virtual void merge( Type * /* other */ ) { }
 
+   /* Point our constituent types at their canonical copies */
+   virtual void rebindTypes(const typeRemap_t &);
+
 public:
    virtual bool operator==(const Type &) const;
    bool isCompatible(boost::shared_ptr<Type> x) { return isCompatible(x.get()); };
@@ -283,6 +289,7 @@ class SYMTAB_EXPORT Field : public Serializable, public FIELD_ANNOTATABLE_CLASS
    int getOffset();
    
    void fixupUnknown(Module *);
+   void rebindType(const typeRemap_t &);
    Serializable * serialize_impl(SerializerBase *sb, 
 		   const char *tag="Field") THROW_SPEC(SerializerError);
    virtual bool operator==(const Field &) const;
@@ -322,6 +329,7 @@ class SYMTAB_EXPORT fieldListType : public Type, public fieldListInterface
    dyn_c_vector<Field *> fieldList;
    dyn_c_vector<Field *> *derivedFieldList;
    fieldListType(std::string &name, typeId_t ID, dataClass typeDes);
+   void rebindTypes(const typeRemap_t &);
    /* Each subclass may need to update its size after adding a field */
  public:
    fieldListType();
@@ -379,6 +387,7 @@ class SYMTAB_EXPORT derivedType : public Type, public derivedInterface {
  protected:
    derivedType(std::string &name, typeId_t id, int size, dataClass typeDes);
    derivedType(std::string &name, int size, dataClass typeDes);
+   void rebindTypes(const typeRemap_t &);
  public:
    derivedType();
    ~derivedType();
@@ -416,6 +425,7 @@ bool Type::isEnumType() { return dynamic_cast<typeEnum*>(this) != NULL; }
 class SYMTAB_EXPORT typeFunction : public Type {
  protected:
    void fixupUnknowns(Module *);
+   void rebindTypes(const typeRemap_t &);
  private:
    boost::shared_ptr<Type> retType_; /* Return type of the function */
    dyn_c_vector<boost::shared_ptr<Type>> params_;
@@ -661,6 +671,7 @@ class SYMTAB_EXPORT typeArray : public rangedType {
  protected:
    void updateSize();
    void merge(Type *other); 
+   void rebindTypes(const typeRemap_t &);
  public:
    typeArray();
    typeArray(typeId_t ID, boost::shared_ptr<Type> base, long low, long hi, std::string name, unsigned int sizeHint = 0);
@@ -54,6 +54,7 @@ extern AnnotationClass<localVarCollection> FunctionLocalVariablesAnno;
 extern AnnotationClass<localVarCollection> FunctionParametersAnno;
 extern AnnotationClass<std::vector<std::string> > SymbolVersionNamesAnno;
 extern AnnotationClass<std::string> SymbolFileNameAnno;
+extern AnnotationClass<std::string> SymbolFileNameRefAnno;
 extern AnnotationClass<std::vector<Function *> > UserFuncsAnno;
 extern AnnotationClass<std::vector<Region *> > UserRegionsAnno; 
 extern AnnotationClass<std::vector<Type *> > UserTypesAnno;